@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
+#include <limits.h>
 
 // Estrutura para representar uma sala (nó da árvore binária do mapa)
 typedef struct Sala {
@@ -23,6 +25,7 @@ typedef struct HashNode {
     char pista[50];         // Chave (pista)
     char suspeito[50];      // Valor (nome do suspeito)
     char descricao[100];    // Descrição narrativa da pista
+    int bit;                // Bit da pista na máscara de evidências do caso (-1 se o caso não a usa)
     struct HashNode *proximo; // Ponteiro para o próximo nó (em caso de colisão)
 } HashNode;
 
@@ -32,6 +35,51 @@ typedef struct {
     HashNode *tabela[TAMANHO_HASH]; // Array de ponteiros para listas encadeadas
 } TabelaHash;
 
+// Máximo de pistas que as regras de um caso podem referenciar (uma por bit da máscara)
+#define MAX_PISTAS_CASO 64
+
+// Limites do arquivo do caso: peso de uma pista e tamanho de cada linha
+// (com 64 pistas de peso máximo, a pontuação total cabe com folga em um int)
+#define PESO_MAXIMO 1000
+#define TAMANHO_LINHA_CASO 256
+
+// Estrutura com as regras de julgamento do caso, já compiladas em máscaras de bits
+typedef struct {
+    char culpado[50];                 // Nome do verdadeiro culpado
+    int limiar;                       // Pontuação mínima para condenar o culpado
+    int numPistas;                    // Pistas que receberam um bit na máscara de evidências
+    int pesos[MAX_PISTAS_CASO];       // Peso de cada pista, indexado pelo bit da pista
+    uint64_t pesosDefinidos;          // Pistas com peso definido pelo arquivo do caso
+    int pontuacaoMaxima;              // Soma de todos os pesos (calculada ao compilar o caso)
+    uint64_t* conjuntos;              // Conjuntos de evidências exigidos; basta completar um deles
+    int numConjuntos;                 // Quantidade de conjuntos exigidos (0 = nenhum)
+    int capacidadeConjuntos;          // Espaço alocado no array de conjuntos
+    char textoVitoria[512];           // Narrativa da acusação correta (vazia = texto genérico; até 511 bytes)
+    char textoInsuficiente[512];      // Narrativa quando faltam evidências (vazia = texto genérico)
+    char textoIncorreto[512];         // Narrativa quando o acusado é inocente (vazia = texto genérico)
+} Caso;
+
+// Faixa da distribuição do modo solucionador: rotas que terminam com a mesma pontuação
+typedef struct {
+    int pontos;                   // Pontuação de evidências da faixa
+    int rotas;                    // Rotas que terminam com essa pontuação
+    int vitorias;                 // Dessas rotas, quantas condenam o culpado
+} FaixaPontuacao;
+
+// Estrutura com o resultado da análise de todas as rotas da mansão
+typedef struct {
+    int totalRotas;               // Quantidade de rotas analisadas (uma por cômodo de parada)
+    int rotasVencedoras;          // Rotas com pistas suficientes para condenar o culpado
+    FaixaPontuacao* faixas;       // Só as pontuações que ocorrem, em ordem crescente
+    int numFaixas;                // Quantidade de faixas preenchidas
+    int capacidadeFaixas;         // Espaço alocado no array de faixas
+    int menorMovimentos;          // Movimentos da rota vencedora mais curta (-1 se não houver)
+    char* melhorRota;             // Escolhas ('e'/'d') da rota vencedora mais curta
+} ResultadoSolucao;
+
+// Número máximo de erros de digitação tolerados nas buscas aproximadas
+#define LIMITE_EDICAO 2
+
 // Função para criar uma sala dinamicamente
 // Aloca memória, inicializa o nome e a pista (se fornecida), e define ponteiros filhos como NULL
 Sala* criarSala(const char* nome, const char* pista) {
@@ -100,6 +148,17 @@ PistaNode* inserirPista(PistaNode* raiz, const char* pista) {
     return raiz; // Ignora pista duplicada
 }
 
+// Função para buscar uma pista na árvore BST
+// Retorna o nó da pista ou NULL se ela não foi coletada
+PistaNode* buscarPista(PistaNode* raiz, const char* pista) {
+    while (raiz != NULL) {
+        int cmp = strcmp(pista, raiz->pista);
+        if (cmp == 0) return raiz;
+        raiz = cmp < 0 ? raiz->esquerda : raiz->direita;
+    }
+    return NULL;
+}
+
 // Função para inserir uma associação pista-suspeito na tabela hash
 // Usa encadeamento para lidar com colisões, inserindo no início da lista
 void inserirNaHash(TabelaHash* tabela, const char* pista, const char* suspeito, const char* descricao) {
@@ -112,6 +171,7 @@ void inserirNaHash(TabelaHash* tabela, const char* pista, const char* suspeito,
     strncpy(novoNo->pista, pista, sizeof(novoNo->pista));
     strncpy(novoNo->suspeito, suspeito, sizeof(novoNo->suspeito));
     strncpy(novoNo->descricao, descricao, sizeof(novoNo->descricao));
+    novoNo->bit = -1; // Só recebe um bit se as regras do caso usarem a pista
     novoNo->proximo = NULL;
 
     // Inserção no início da lista encadeada
@@ -147,6 +207,139 @@ void exibirPistas(PistaNode* raiz, TabelaHash* tabela) {
     }
 }
 
+// Tipo das funções chamadas para cada pista encontrada nas buscas da BST
+typedef void (*VisitarPista)(PistaNode* no, void* contexto);
+
+// Função para buscar as pistas que começam com um prefixo, em ordem alfabética
+// Aproveita a ordem da BST para descartar subárvores fora do intervalo do prefixo;
+// chama visitar para cada pista encontrada e retorna quantas foram encontradas
+int buscarPistasPorPrefixo(PistaNode* raiz, const char* prefixo, VisitarPista visitar, void* contexto) {
+    if (raiz == NULL) return 0;
+    int encontradas = 0;
+    int cmp = strncmp(raiz->pista, prefixo, strlen(prefixo));
+    if (cmp >= 0) {
+        encontradas += buscarPistasPorPrefixo(raiz->esquerda, prefixo, visitar, contexto);
+    }
+    if (cmp == 0) {
+        visitar(raiz, contexto);
+        encontradas++;
+    }
+    if (cmp <= 0) {
+        encontradas += buscarPistasPorPrefixo(raiz->direita, prefixo, visitar, contexto);
+    }
+    return encontradas;
+}
+
+// Função para exibir uma pista com seu suspeito (o contexto é a tabela hash)
+void exibirPistaComSuspeito(PistaNode* no, void* contexto) {
+    HashNode* node = encontrarSuspeito((TabelaHash*)contexto, no->pista);
+    printf(" - %s (Suspeito: %s)\n", no->pista, node ? node->suspeito : "Desconhecido");
+}
+
+// Função para exibir apenas o nome de uma pista
+void exibirNomePista(PistaNode* no, void* contexto) {
+    (void)contexto;
+    printf(" - %s\n", no->pista);
+}
+
+// Função para calcular a distância de edição (Levenshtein) entre duas strings
+// Ignora maiúsculas/minúsculas e para assim que a distância ultrapassa o limite,
+// retornando limite + 1 nesse caso
+int distanciaEdicao(const char* a, const char* b, int limite) {
+    int tamA = strlen(a), tamB = strlen(b);
+    if (tamA > 49) tamA = 49;
+    if (tamB > 49) tamB = 49;
+    if (abs(tamA - tamB) > limite) return limite + 1;
+
+    int anterior[50], atual[50];
+    for (int j = 0; j <= tamB; j++) anterior[j] = j;
+    for (int i = 1; i <= tamA; i++) {
+        atual[0] = i;
+        int menorDaLinha = atual[0];
+        for (int j = 1; j <= tamB; j++) {
+            int custo = tolower((unsigned char)a[i - 1]) != tolower((unsigned char)b[j - 1]);
+            int valor = anterior[j - 1] + custo;
+            if (anterior[j] + 1 < valor) valor = anterior[j] + 1;
+            if (atual[j - 1] + 1 < valor) valor = atual[j - 1] + 1;
+            atual[j] = valor;
+            if (valor < menorDaLinha) menorDaLinha = valor;
+        }
+        if (menorDaLinha > limite) return limite + 1; // Nenhum caminho volta para dentro do limite
+        memcpy(anterior, atual, sizeof(int) * (tamB + 1));
+    }
+    return anterior[tamB] <= limite ? anterior[tamB] : limite + 1;
+}
+
+// Função para buscar as pistas coletadas cujo início é parecido com o termo
+// Compara o termo com os primeiros strlen(termo) caracteres de cada pista, então
+// funciona como uma busca por prefixo que tolera maiúsculas e erros de digitação.
+// Percorre todas as pistas coletadas (no máximo uma por cômodo visitado); a distância
+// de prefixo não é uma métrica, então não dá para podar com uma BK-tree
+// Chama visitar para cada pista encontrada, em ordem alfabética, e retorna quantas foram encontradas
+int buscarPistasParecidas(PistaNode* raiz, const char* termo, VisitarPista visitar, void* contexto) {
+    if (raiz == NULL) return 0;
+    int encontradas = buscarPistasParecidas(raiz->esquerda, termo, visitar, contexto);
+    char inicio[50];
+    snprintf(inicio, sizeof(inicio), "%.*s", (int)strlen(termo), raiz->pista);
+    if (distanciaEdicao(termo, inicio, LIMITE_EDICAO) <= LIMITE_EDICAO) {
+        visitar(raiz, contexto);
+        encontradas++;
+    }
+    return encontradas + buscarPistasParecidas(raiz->direita, termo, visitar, contexto);
+}
+
+// Função para pesquisar as pistas coletadas por prefixo
+// Se nenhuma pista começar com o termo, sugere as pistas com início parecido
+// (termos curtos demais não são aproximados, pois casariam com qualquer pista)
+void pesquisarPistas(PistaNode* raiz, TabelaHash* tabela) {
+    char termo[50];
+    printf("Digite o início da pista (ex.: Pegadas): ");
+    if (scanf(" %49[^\n]", termo) != 1) return;
+    while (getchar() != '\n');
+
+    printf("\nPistas que começam com '%s':\n", termo);
+    if (buscarPistasPorPrefixo(raiz, termo, exibirPistaComSuspeito, tabela) == 0) {
+        printf("Nenhuma pista encontrada com esse início.\n");
+        if (strlen(termo) > LIMITE_EDICAO) {
+            printf("Pistas com início parecido:\n");
+            if (buscarPistasParecidas(raiz, termo, exibirNomePista, NULL) == 0) {
+                printf("Nenhuma.\n");
+            }
+        }
+    }
+}
+
+// Função para encontrar o suspeito registrado mais parecido com um nome
+// Considera só as associações vigentes (a inserção mais recente de cada pista).
+// Prefere o nome exato; senão, retorna o mais próximo dentro do limite de edição ou NULL
+const char* suspeitoMaisProximo(TabelaHash* tabela, const char* nome) {
+    const char* maisProximo = NULL;
+    int menorDistancia = LIMITE_EDICAO + 1;
+    for (int i = 0; i < TAMANHO_HASH; i++) {
+        for (HashNode* atual = tabela->tabela[i]; atual != NULL; atual = atual->proximo) {
+            if (encontrarSuspeito(tabela, atual->pista) != atual) continue; // Entrada sobrescrita
+            if (strcmp(nome, atual->suspeito) == 0) {
+                return atual->suspeito;
+            }
+            int distancia = distanciaEdicao(nome, atual->suspeito, LIMITE_EDICAO);
+            if (distancia < menorDistancia) {
+                menorDistancia = distancia;
+                maisProximo = atual->suspeito;
+            }
+        }
+    }
+    return maisProximo;
+}
+
+// Função para corrigir o nome do suspeito acusado em caso de erro de digitação
+void corrigirSuspeito(TabelaHash* tabela, char* acusado) {
+    const char* maisProximo = suspeitoMaisProximo(tabela, acusado);
+    if (maisProximo != NULL && strcmp(maisProximo, acusado) != 0) {
+        printf("Considerando '%s' como '%s'.\n", acusado, maisProximo);
+        strcpy(acusado, maisProximo);
+    }
+}
+
 // Função para contar pistas por suspeito
 void contarPistasPorSuspeito(TabelaHash* tabela, PistaNode* raiz, int* contagem, char suspeitos[][50], int* numSuspeitos) {
     if (raiz == NULL) return;
@@ -169,9 +362,238 @@ void contarPistasPorSuspeito(TabelaHash* tabela, PistaNode* raiz, int* contagem,
     contarPistasPorSuspeito(tabela, raiz->direita, contagem, suspeitos, numSuspeitos);
 }
 
+// Função para preencher o caso padrão (o Coronel, com duas pistas contra ele)
+// As narrativas ficam vazias: o julgamento usa textos genéricos montados a partir das regras
+void criarCasoPadrao(Caso* caso) {
+    memset(caso, 0, sizeof(Caso));
+    strcpy(caso->culpado, "Coronel");
+    caso->limiar = 2;
+}
+
+// Função para liberar a memória alocada pelas regras do caso
+void liberarCaso(Caso* caso) {
+    free(caso->conjuntos);
+    caso->conjuntos = NULL;
+    caso->numConjuntos = 0;
+    caso->capacidadeConjuntos = 0;
+}
+
+// Função para remover espaços no início e no fim de um texto
+char* aparar(char* texto) {
+    while (isspace((unsigned char)*texto)) texto++;
+    char* fim = texto + strlen(texto);
+    while (fim > texto && isspace((unsigned char)fim[-1])) fim--;
+    *fim = '\0';
+    return texto;
+}
+
+// Função para ler um inteiro entre 0 e maximo
+// Retorna 1 se o texto inteiro for um número válido ou 0 caso contrário
+int lerInteiroLimitado(const char* texto, int maximo, int* valor) {
+    char* fim;
+    long numero = strtol(texto, &fim, 10);
+    if (fim == texto || *fim != '\0' || numero < 0 || numero > maximo) return 0;
+    *valor = (int)numero;
+    return 1;
+}
+
+// Função para obter o bit de evidência de uma pista da tabela hash
+// Retorna 0 (nenhum bit) se a pista não existir ou não for usada pelo caso
+uint64_t bitDaPista(HashNode* node) {
+    return (node != NULL && node->bit >= 0) ? (uint64_t)1 << node->bit : 0;
+}
+
+// Função para reservar um bit da máscara de evidências para uma pista
+// Retorna 0 se o caso já usa o máximo de pistas permitido
+int reservarBit(Caso* caso, HashNode* node) {
+    if (node->bit >= 0) return 1;
+    if (caso->numPistas >= MAX_PISTAS_CASO) {
+        printf("Erro: As regras do caso usam mais de %d pistas!\n", MAX_PISTAS_CASO);
+        return 0;
+    }
+    node->bit = caso->numPistas++;
+    caso->pesos[node->bit] = 0;
+    return 1;
+}
+
+// Função para acrescentar um conjunto de evidências exigido, ampliando o array se necessário
+void adicionarConjunto(Caso* caso, uint64_t conjunto) {
+    if (caso->numConjuntos == caso->capacidadeConjuntos) {
+        int novaCapacidade = caso->capacidadeConjuntos ? caso->capacidadeConjuntos * 2 : 8;
+        uint64_t* novos = (uint64_t*)realloc(caso->conjuntos, novaCapacidade * sizeof(uint64_t));
+        if (novos == NULL) {
+            printf("Erro: Falha na alocação de memória para regras do caso!\n");
+            exit(1);
+        }
+        caso->conjuntos = novos;
+        caso->capacidadeConjuntos = novaCapacidade;
+    }
+    caso->conjuntos[caso->numConjuntos++] = conjunto;
+}
+
+// Função para carregar as regras do caso a partir de um arquivo texto
+// Cada linha tem o formato chave=valor; linhas vazias ou iniciadas por '#' são ignoradas:
+//   culpado=Nome        limiar=N        peso=Pista;N
+//   exige=Pista;Pista   vitoria=Texto   insuficiente=Texto   incorreto=Texto
+// Linhas com mais de TAMANHO_LINHA_CASO - 2 caracteres invalidam o caso, pois cortá-las
+// mudaria a regra. Retorna 1 se o arquivo foi lido, 0 se ele não existe (o caso fica
+// inalterado) ou -1 se uma regra não pode ser montada
+int carregarCaso(const char* arquivo, Caso* caso, TabelaHash* tabela) {
+    FILE* entrada = fopen(arquivo, "r");
+    if (entrada == NULL) return 0;
+
+    char linha[TAMANHO_LINHA_CASO];
+    int numLinha = 0;
+    while (fgets(linha, sizeof(linha), entrada) != NULL) {
+        numLinha++;
+        if (strchr(linha, '\n') == NULL && !feof(entrada)) {
+            printf("Erro: linha %d de %s passa de %d caracteres.\n", numLinha, arquivo, TAMANHO_LINHA_CASO - 2);
+            fclose(entrada);
+            return -1;
+        }
+        char* conteudo = aparar(linha);
+        if (conteudo[0] == '\0' || conteudo[0] == '#') continue;
+
+        char* separador = strchr(conteudo, '=');
+        if (separador == NULL) {
+            printf("Aviso: linha %d de %s ignorada (falta '=').\n", numLinha, arquivo);
+            continue;
+        }
+        *separador = '\0';
+        char* chave = aparar(conteudo);
+        char* valor = aparar(separador + 1);
+
+        if (strcmp(chave, "culpado") == 0) {
+            strncpy(caso->culpado, valor, sizeof(caso->culpado) - 1);
+            caso->culpado[sizeof(caso->culpado) - 1] = '\0';
+        } else if (strcmp(chave, "limiar") == 0) {
+            if (!lerInteiroLimitado(valor, INT_MAX, &caso->limiar)) {
+                printf("Aviso: linha %d de %s ignorada (limiar inválido).\n", numLinha, arquivo);
+            }
+        } else if (strcmp(chave, "peso") == 0) {
+            char* pesoTexto = strrchr(valor, ';');
+            HashNode* node = NULL;
+            int peso;
+            if (pesoTexto != NULL) {
+                *pesoTexto = '\0';
+                node = encontrarSuspeito(tabela, aparar(valor));
+            }
+            if (node == NULL) {
+                printf("Aviso: linha %d de %s ignorada (pista desconhecida).\n", numLinha, arquivo);
+                continue;
+            }
+            if (!lerInteiroLimitado(aparar(pesoTexto + 1), PESO_MAXIMO, &peso)) {
+                printf("Aviso: linha %d de %s ignorada (peso inválido; use de 0 a %d).\n", numLinha, arquivo, PESO_MAXIMO);
+                continue;
+            }
+            if (!reservarBit(caso, node)) {
+                fclose(entrada);
+                return -1;
+            }
+            caso->pesos[node->bit] = peso;
+            caso->pesosDefinidos |= bitDaPista(node);
+        } else if (strcmp(chave, "exige") == 0) {
+            // Um conjunto exigido com pista desconhecida invalida o caso:
+            // ignorá-lo tornaria a acusação mais fácil do que o caso pede
+            uint64_t conjunto = 0;
+            for (char* pista = strtok(valor, ";"); pista != NULL; pista = strtok(NULL, ";")) {
+                HashNode* node = encontrarSuspeito(tabela, aparar(pista));
+                if (node == NULL) {
+                    printf("Erro: pista '%s' desconhecida no conjunto exigido da linha %d de %s.\n",
+                           aparar(pista), numLinha, arquivo);
+                    fclose(entrada);
+                    return -1;
+                }
+                if (!reservarBit(caso, node)) {
+                    fclose(entrada);
+                    return -1;
+                }
+                conjunto |= bitDaPista(node);
+            }
+            if (conjunto == 0) {
+                printf("Erro: conjunto exigido vazio na linha %d de %s.\n", numLinha, arquivo);
+                fclose(entrada);
+                return -1;
+            }
+            adicionarConjunto(caso, conjunto);
+        } else if (strcmp(chave, "vitoria") == 0 || strcmp(chave, "insuficiente") == 0 ||
+                   strcmp(chave, "incorreto") == 0) {
+            char* texto = caso->textoIncorreto;
+            if (strcmp(chave, "vitoria") == 0) {
+                texto = caso->textoVitoria;
+            } else if (strcmp(chave, "insuficiente") == 0) {
+                texto = caso->textoInsuficiente;
+            }
+            size_t usado = strlen(texto);
+            size_t livre = sizeof(caso->textoVitoria) - usado;
+            if ((size_t)snprintf(texto + usado, livre, "%s\n", valor) >= livre) {
+                printf("Aviso: narrativa '%s' truncada na linha %d de %s (máximo de %d bytes).\n",
+                       chave, numLinha, arquivo, (int)sizeof(caso->textoVitoria) - 1);
+            }
+        } else {
+            printf("Aviso: chave '%s' desconhecida na linha %d de %s.\n", chave, numLinha, arquivo);
+        }
+    }
+    fclose(entrada);
+    return 1;
+}
+
+// Função para compilar as regras do caso
+// Pistas sem peso definido valem 1 ponto se apontam para o culpado e 0 caso contrário;
+// só as pistas que pontuam ou aparecem em conjuntos exigidos ocupam bits da máscara.
+// Retorna 0 se o caso precisar de mais bits do que a máscara comporta
+// ou se a soma dos pesos não couber em um int
+int compilarCaso(Caso* caso, TabelaHash* tabela) {
+    for (int i = 0; i < TAMANHO_HASH; i++) {
+        for (HashNode* atual = tabela->tabela[i]; atual != NULL; atual = atual->proximo) {
+            if (encontrarSuspeito(tabela, atual->pista) != atual) continue; // Entrada sobrescrita
+            if (caso->pesosDefinidos & bitDaPista(atual)) continue;
+            if (strcmp(atual->suspeito, caso->culpado) == 0) {
+                if (!reservarBit(caso, atual)) return 0;
+                caso->pesos[atual->bit] = 1;
+            }
+        }
+    }
+    caso->pontuacaoMaxima = 0;
+    for (int i = 0; i < caso->numPistas; i++) {
+        if (caso->pesos[i] > INT_MAX - caso->pontuacaoMaxima) {
+            printf("Erro: A soma dos pesos do caso é grande demais!\n");
+            return 0;
+        }
+        caso->pontuacaoMaxima += caso->pesos[i];
+    }
+    return 1;
+}
+
+// Função para somar os pesos das pistas presentes na máscara de evidências
+int pontuacaoEvidencias(const Caso* caso, uint64_t mascara) {
+    int pontos = 0;
+    for (int i = 0; mascara != 0; i++, mascara >>= 1) {
+        if (mascara & 1u) pontos += caso->pesos[i];
+    }
+    return pontos;
+}
+
+// Função para verificar se um conjunto obrigatório de evidências foi completado
+// Sem conjuntos exigidos, a pontuação basta
+int conjuntoCompleto(const Caso* caso, uint64_t mascara) {
+    if (caso->numConjuntos == 0) return 1;
+    for (int i = 0; i < caso->numConjuntos; i++) {
+        if ((mascara & caso->conjuntos[i]) == caso->conjuntos[i]) return 1;
+    }
+    return 0;
+}
+
+// Função para verificar se as evidências bastam para condenar o culpado
+int evidenciasSuficientes(const Caso* caso, uint64_t mascara) {
+    return pontuacaoEvidencias(caso, mascara) >= caso->limiar && conjuntoCompleto(caso, mascara);
+}
+
 // Função para verificar o suspeito acusado e determinar o resultado
-// Verifica se o acusado é o Coronel e se há pelo menos duas pistas específicas
-void verificarSuspeitoFinal(TabelaHash* tabela, PistaNode* pistasRaiz, const char* acusado) {
+// Verifica se o acusado é o culpado do caso e se as evidências coletadas bastam
+// A máscara de evidências é mantida durante a exploração, então o julgamento não percorre a BST
+void verificarSuspeitoFinal(TabelaHash* tabela, PistaNode* pistasRaiz, const Caso* caso, uint64_t evidencias,
+                            const char* acusado) {
     int contagem[10] = {0}; // Suporta até 10 suspeitos
     char suspeitos[10][50];
     int numSuspeitos = 0;
@@ -204,20 +626,38 @@ void verificarSuspeitoFinal(TabelaHash* tabela, PistaNode* pistasRaiz, const cha
         }
     }
 
+    int pontos = pontuacaoEvidencias(caso, evidencias);
+
     printf("\nVocê acusou: %s\n", acusado);
-    if (strcmp(acusado, "Coronel") == 0 && pistasAcusado >= 2) {
-        printf("Parabéns! Sua acusação está correta! O Coronel é o culpado.\n");
-        printf("As pistas encontradas, como 'Pegadas de lama', 'Livro com marcação' e 'Botão de uniforme', apontam diretamente para ele.\n");
-        printf("As pegadas mostram que ele esteve no local do crime, o livro revela seu motivo, e o botão confirma sua presença.\n");
-    } else if (strcmp(acusado, "Coronel") == 0 && pistasAcusado < 2) {
-        printf("Acusação insuficiente! Você tem apenas %d pista(s) contra o Coronel.\n", pistasAcusado);
-        printf("Você precisa de pelo menos 2 pistas, como 'Pegadas de lama', 'Livro com marcação' ou 'Botão de uniforme', para confirmar sua culpa.\n");
+    if (strcmp(acusado, caso->culpado) == 0 && evidenciasSuficientes(caso, evidencias)) {
+        printf("Parabéns! Sua acusação está correta! %s é o(a) culpado(a).\n", caso->culpado);
+        if (caso->textoVitoria[0] != '\0') {
+            printf("%s", caso->textoVitoria);
+        } else {
+            printf("As pistas coletadas somam %d ponto(s) contra %s e comprovam sua culpa.\n", pontos, caso->culpado);
+        }
+    } else if (strcmp(acusado, caso->culpado) == 0) {
+        printf("Acusação insuficiente! Suas pistas contra %s somam %d ponto(s), de %d necessários.\n",
+               caso->culpado, pontos, caso->limiar);
+        if (!conjuntoCompleto(caso, evidencias)) {
+            printf("Ainda falta reunir um conjunto completo de evidências essenciais.\n");
+        }
+        if (caso->textoInsuficiente[0] != '\0') {
+            printf("%s", caso->textoInsuficiente);
+        } else {
+            printf("Continue explorando a mansão em busca de mais pistas contra %s.\n", caso->culpado);
+        }
     } else {
-        printf("Acusação incorreta! %s não é o culpado.\n", acusado);
+        printf("Acusação incorreta! %s não é o(a) culpado(a).\n", acusado);
         if (pistasAcusado > 0) {
             printf("Embora você tenha %d pista(s) contra %s, elas não são suficientes para provar a culpa.\n", pistasAcusado, acusado);
         }
-        printf("O verdadeiro culpado é o Coronel. Procure por pistas como 'Pegadas de lama', 'Livro com marcação' ou 'Botão de uniforme'.\n");
+        printf("O(A) verdadeiro(a) culpado(a) é %s. ", caso->culpado);
+        if (caso->textoIncorreto[0] != '\0') {
+            printf("%s", caso->textoIncorreto);
+        } else {
+            printf("Procure por pistas que apontem para essa pessoa.\n");
+        }
         if (suspeitoMaisCitado && maxPistas >= 1) {
             printf("Dica: O suspeito mais citado é %s, com %d pista(s).\n", suspeitoMaisCitado, maxPistas);
         }
@@ -231,18 +671,19 @@ char lerEscolha(Sala* atual) {
         printf("Escolha uma direção:\n");
         if (atual->esquerda != NULL) printf("  e - Ir para a esquerda\n");
         if (atual->direita != NULL) printf("  d - Ir para a direita\n");
+        printf("  p - Pesquisar pistas coletadas\n");
         printf("  s - Sair da exploração\n");
         printf("Sua escolha: ");
         if (scanf(" %c", &escolha) != 1) {
             while (getchar() != '\n');
-            printf("Entrada inválida! Use 'e', 'd' ou 's'.\n");
+            printf("Entrada inválida! Use 'e', 'd', 'p' ou 's'.\n");
             continue;
         }
         while (getchar() != '\n');
         escolha = tolower(escolha);
         if ((escolha == 'e' && atual->esquerda != NULL) ||
             (escolha == 'd' && atual->direita != NULL) ||
-            escolha == 's') {
+            escolha == 'p' || escolha == 's') {
             return escolha;
         }
         printf("Opção inválida ou caminho inexistente! Tente novamente.\n");
@@ -250,8 +691,9 @@ char lerEscolha(Sala* atual) {
 }
 
 // Função para explorar as salas e coletar pistas
-// Navega pela árvore binária, exibe pistas com descrições e as insere na BST
-void explorarSalas(Sala* sala, PistaNode** pistasRaiz, TabelaHash* tabela) {
+// Navega pela árvore binária, exibe pistas com descrições e as insere na BST,
+// acumulando o bit de cada pista na máscara de evidências usada no julgamento
+void explorarSalas(Sala* sala, PistaNode** pistasRaiz, TabelaHash* tabela, uint64_t* evidencias) {
     if (sala == NULL) {
         printf("Erro: Mapa da mansão não inicializado!\n");
         return;
@@ -266,6 +708,7 @@ void explorarSalas(Sala* sala, PistaNode** pistasRaiz, TabelaHash* tabela) {
                 printf("Pista encontrada: %s\n", atual->pista);
                 printf("Detalhe: %s\n", node->descricao);
                 *pistasRaiz = inserirPista(*pistasRaiz, atual->pista);
+                *evidencias |= bitDaPista(node);
             } else {
                 printf("Pista encontrada: %s (sem suspeito associado)\n", atual->pista);
             }
@@ -274,19 +717,14 @@ void explorarSalas(Sala* sala, PistaNode** pistasRaiz, TabelaHash* tabela) {
         }
 
         if (atual->esquerda == NULL && atual->direita == NULL) {
-            printf("Este é um cômodo sem saídas. Pressione 's' para sair.\n");
-            char escolha;
-            do {
-                scanf(" %c", &escolha);
-                escolha = tolower(escolha);
-                if (escolha != 's') {
-                    printf("Opção inválida! Pressione 's' para sair.\n");
-                }
-            } while (escolha != 's');
-            break;
+            printf("Este é um cômodo sem saídas.\n");
         }
 
         char escolha = lerEscolha(atual);
+        while (escolha == 'p') {
+            pesquisarPistas(*pistasRaiz, tabela);
+            escolha = lerEscolha(atual);
+        }
         if (escolha == 's') {
             break;
         } else if (escolha == 'e') {
@@ -297,6 +735,141 @@ void explorarSalas(Sala* sala, PistaNode** pistasRaiz, TabelaHash* tabela) {
     }
 }
 
+// Função para calcular a altura da árvore de salas (maior número de movimentos)
+int alturaArvoreSalas(Sala* sala) {
+    if (sala == NULL) return -1;
+    int esquerda = alturaArvoreSalas(sala->esquerda);
+    int direita = alturaArvoreSalas(sala->direita);
+    return 1 + (esquerda > direita ? esquerda : direita);
+}
+
+// Função para contar uma rota na faixa da sua pontuação
+// As faixas ficam ordenadas por pontuação; uma faixa nova é inserida na posição certa
+void registrarPontuacao(ResultadoSolucao* resultado, int pontos, int venceu) {
+    int inicio = 0, fim = resultado->numFaixas - 1;
+    while (inicio <= fim) {
+        int meio = (inicio + fim) / 2;
+        if (resultado->faixas[meio].pontos == pontos) {
+            resultado->faixas[meio].rotas++;
+            resultado->faixas[meio].vitorias += venceu;
+            return;
+        }
+        if (resultado->faixas[meio].pontos < pontos) inicio = meio + 1;
+        else fim = meio - 1;
+    }
+    if (resultado->numFaixas == resultado->capacidadeFaixas) {
+        int novaCapacidade = resultado->capacidadeFaixas ? resultado->capacidadeFaixas * 2 : 8;
+        FaixaPontuacao* novas = (FaixaPontuacao*)realloc(resultado->faixas, novaCapacidade * sizeof(FaixaPontuacao));
+        if (novas == NULL) {
+            printf("Erro: Falha na alocação de memória para rotas!\n");
+            exit(1);
+        }
+        resultado->faixas = novas;
+        resultado->capacidadeFaixas = novaCapacidade;
+    }
+    memmove(&resultado->faixas[inicio + 1], &resultado->faixas[inicio],
+            (resultado->numFaixas - inicio) * sizeof(FaixaPontuacao));
+    resultado->faixas[inicio].pontos = pontos;
+    resultado->faixas[inicio].rotas = 1;
+    resultado->faixas[inicio].vitorias = venceu;
+    resultado->numFaixas++;
+}
+
+// Função para analisar recursivamente todas as rotas a partir de uma sala
+// Cada cômodo é um ponto de parada possível; acumula na máscara as pistas do caminho
+// e registra a rota vencedora mais curta
+void analisarRotas(Sala* sala, TabelaHash* tabela, const Caso* caso, char* rota, int movimentos,
+                   uint64_t mascara, ResultadoSolucao* resultado) {
+    if (sala == NULL) return;
+
+    if (sala->pista[0] != '\0') {
+        mascara |= bitDaPista(encontrarSuspeito(tabela, sala->pista)); // Pistas repetidas não mudam a máscara
+    }
+
+    int venceu = evidenciasSuficientes(caso, mascara);
+    resultado->totalRotas++;
+    registrarPontuacao(resultado, pontuacaoEvidencias(caso, mascara), venceu);
+    if (venceu) {
+        resultado->rotasVencedoras++;
+        if (resultado->menorMovimentos < 0 || movimentos < resultado->menorMovimentos) {
+            resultado->menorMovimentos = movimentos;
+            memcpy(resultado->melhorRota, rota, movimentos);
+            resultado->melhorRota[movimentos] = '\0';
+        }
+    }
+
+    rota[movimentos] = 'e';
+    analisarRotas(sala->esquerda, tabela, caso, rota, movimentos + 1, mascara, resultado);
+    rota[movimentos] = 'd';
+    analisarRotas(sala->direita, tabela, caso, rota, movimentos + 1, mascara, resultado);
+}
+
+// Função do modo solucionador
+// Analisa todas as rotas da mansão e mostra a taxa de vitória e a rota vencedora mais curta
+void solucionarMansao(Sala* hall, TabelaHash* tabela, const Caso* caso) {
+    ResultadoSolucao resultado;
+    memset(&resultado, 0, sizeof(resultado));
+    resultado.menorMovimentos = -1;
+
+    // Rotas têm no máximo altura movimentos; os buffers são dimensionados pela árvore
+    int altura = alturaArvoreSalas(hall);
+    char* rota = (char*)malloc(altura + 1);
+    resultado.melhorRota = (char*)malloc(altura + 1);
+    if (rota == NULL || resultado.melhorRota == NULL) {
+        printf("Erro: Falha na alocação de memória para rotas!\n");
+        exit(1);
+    }
+    analisarRotas(hall, tabela, caso, rota, 0, 0, &resultado);
+    free(rota);
+
+    printf("\nModo Solucionador\n");
+    printf("Rotas analisadas: %d\n", resultado.totalRotas);
+    if (resultado.totalRotas == 0) {
+        printf("Mapa da mansão vazio.\n");
+    } else {
+        printf("Rotas que condenam %s: %d (%.1f%%)\n", caso->culpado, resultado.rotasVencedoras,
+               100.0 * resultado.rotasVencedoras / resultado.totalRotas);
+
+        printf("\nDistribuição de rotas por pontuação de evidências (limiar: %d):\n", caso->limiar);
+        for (int i = 0; i < resultado.numFaixas; i++) {
+            printf(" - %d ponto(s): %d rota(s), %d vitória(s)\n", resultado.faixas[i].pontos,
+                   resultado.faixas[i].rotas, resultado.faixas[i].vitorias);
+        }
+
+        if (resultado.menorMovimentos < 0) {
+            printf("\nNenhuma rota reúne evidências suficientes contra %s.\n", caso->culpado);
+        } else {
+            printf("\nRota vencedora mais curta (%d movimento(s)):\n", resultado.menorMovimentos);
+            Sala* atual = hall;
+            printf(" %s", atual->nome);
+            for (int i = 0; i < resultado.menorMovimentos; i++) {
+                atual = resultado.melhorRota[i] == 'e' ? atual->esquerda : atual->direita;
+                printf(" -> %s", atual->nome);
+            }
+            printf("\n");
+        }
+    }
+    free(resultado.melhorRota);
+    free(resultado.faixas);
+}
+
+// Função para ler o modo de jogo escolhido
+int lerModo() {
+    int modo;
+    while (1) {
+        printf("\nEscolha o modo:\n");
+        printf("  1 - Jogar\n");
+        printf("  2 - Modo solucionador (analisa todas as rotas)\n");
+        printf("Sua escolha: ");
+        if (scanf("%d", &modo) == 1 && (modo == 1 || modo == 2)) {
+            while (getchar() != '\n');
+            return modo;
+        }
+        while (getchar() != '\n');
+        printf("Opção inválida! Digite 1 ou 2.\n");
+    }
+}
+
 // Função para liberar a memória da árvore binária do mapa
 void liberarArvoreSalas(Sala* sala) {
     if (sala == NULL) return;
@@ -327,6 +900,8 @@ void liberarTabelaHash(TabelaHash* tabela) {
 }
 
 // Função principal
+// Fica de fora quando o arquivo é incluído pelo teste das estruturas (teste_estruturas.c)
+#ifndef TESTE_ESTRUTURAS
 int main() {
     // Criação do mapa da mansão (árvore binária)
     Sala* hall = criarSala("Hall de Entrada", NULL);
@@ -357,23 +932,42 @@ int main() {
     inserirNaHash(tabela, "Botão de uniforme", "Coronel", "Um botão militar encontrado perto da cena do crime.");
     inserirNaHash(tabela, "Faca afiada", "Mordomo", "Uma faca limpa, sem sinais de uso recente.");
 
+    // Regras do julgamento: caso padrão, ajustado pelo arquivo do caso se ele existir
+    Caso caso;
+    criarCasoPadrao(&caso);
+    if (carregarCaso("caso.txt", &caso, tabela) < 0 || !compilarCaso(&caso, tabela)) {
+        printf("Erro: Não foi possível montar as regras do caso!\n");
+        exit(1);
+    }
+
     // Início do jogo
     printf("Bem-vindo ao Detective Quest (Nível Mestre)!\n");
-    printf("Explore a mansão, colete pistas e descubra quem é o verdadeiro culpado.\n");
+    if (lerModo() == 2) {
+        solucionarMansao(hall, tabela, &caso);
+        liberarArvoreSalas(hall);
+        liberarTabelaHash(tabela);
+        liberarCaso(&caso);
+        return 0;
+    }
+    printf("Explore a mansão, colete pistas e descubra quem cometeu o crime.\n");
     printf("Dica: Leia as descrições das pistas para entender quem está por trás do crime!\n");
-    explorarSalas(hall, &pistasRaiz, tabela);
+    uint64_t evidencias = 0; // Máscara das pistas coletadas que contam para o caso
+    explorarSalas(hall, &pistasRaiz, tabela, &evidencias);
 
     // Fase de julgamento
     char acusado[50];
     printf("\nFase de Julgamento\n");
     printf("Digite o nome do suspeito que você acusa (ex.: Coronel, Mordomo): ");
-    scanf(" %[^\n]", acusado);
-    verificarSuspeitoFinal(tabela, pistasRaiz, acusado);
+    scanf(" %49[^\n]", acusado);
+    corrigirSuspeito(tabela, acusado);
+    verificarSuspeitoFinal(tabela, pistasRaiz, &caso, evidencias, acusado);
 
     // Liberação da memória
     liberarArvoreSalas(hall);
     liberarArvorePistas(pistasRaiz);
     liberarTabelaHash(tabela);
+    liberarCaso(&caso);
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
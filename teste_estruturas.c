@@ -0,0 +1,484 @@
+// Teste diferencial das estruturas de dados do Detective Quest (Nível Mestre)
+//
+// Executa uma sequência aleatória (com semente) de operações sobre a tabela hash, a BST
+// de pistas e a árvore de salas, e compara cada resultado com um modelo de referência
+// simples: um mapa com busca linear para a tabela hash e um array ordenado para a BST.
+// Também confere as buscas por prefixo, por início parecido e a correção do nome do
+// suspeito, além dos invariantes internos das estruturas antes de cada liberação.
+// Depois da verificação, mede a vazão (operações por segundo) de cada estrutura.
+//
+// Compilação com sanitizers e execução:
+//   gcc -g -fsanitize=address,undefined teste_estruturas.c -o teste_estruturas
+//   ./teste_estruturas [semente] [operacoes]
+//
+// Para trocar uma estrutura por uma versão mais rápida, mantenha as mesmas funções em
+// "detective-quest MESTRE.c" (inserirNaHash, encontrarSuspeito, inserirPista, buscarPista,
+// buscarPistasPorPrefixo, liberarTabelaHash, ...) e rode o teste com as mesmas sementes antes e depois da troca.
+
+#define TESTE_ESTRUTURAS
+#include "detective-quest MESTRE.c"
+#include <time.h>
+
+#define NUM_CHAVES 1024  // Pistas distintas sorteadas para as operações
+#define LOTE 1024        // Operações por lote na medição de vazão
+
+// Entrada do modelo de referência da tabela hash
+typedef struct {
+    char pista[50];
+    char suspeito[50];
+    char descricao[100];
+} EntradaReferencia;
+
+// Modelo de referência: mapa com busca linear e array ordenado de pistas sem repetição
+typedef struct {
+    EntradaReferencia* mapa;
+    int tamMapa, capMapa;
+    char (*ordenadas)[50];
+    int tamOrdenadas, capOrdenadas;
+} Referencia;
+
+static const char* SUSPEITOS[] = {"Coronel", "Mordomo", "Governanta", "Jardineiro", "Cozinheira"};
+static char chaves[NUM_CHAVES][50];
+
+// Gerador pseudoaleatório xorshift64*, reproduzível a partir da semente
+uint64_t aleatorio(uint64_t* estado) {
+    *estado ^= *estado >> 12;
+    *estado ^= *estado << 25;
+    *estado ^= *estado >> 27;
+    return *estado * 2685821657736338717ULL;
+}
+
+// Função para sortear um texto com tamanho entre 1 e tamanhoMaximo
+void textoAleatorio(uint64_t* estado, char* destino, int tamanhoMaximo) {
+    static const char alfabeto[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+    int tamanho = 1 + aleatorio(estado) % tamanhoMaximo;
+    for (int i = 0; i < tamanho; i++) {
+        destino[i] = alfabeto[aleatorio(estado) % (sizeof(alfabeto) - 1)];
+    }
+    destino[tamanho] = '\0';
+}
+
+// Função para interromper o teste ao encontrar uma divergência
+void falhar(long operacao, const char* estrutura, const char* detalhe) {
+    printf("FALHA na operação %ld (%s): %s\n", operacao, estrutura, detalhe);
+    exit(1);
+}
+
+// Função de referência: distância de Levenshtein completa, sem limite
+int distanciaReferencia(const char* a, const char* b) {
+    int tamA = strlen(a), tamB = strlen(b);
+    int d[50][50];
+    for (int i = 0; i <= tamA; i++) d[i][0] = i;
+    for (int j = 0; j <= tamB; j++) d[0][j] = j;
+    for (int i = 1; i <= tamA; i++) {
+        for (int j = 1; j <= tamB; j++) {
+            int custo = tolower((unsigned char)a[i - 1]) != tolower((unsigned char)b[j - 1]);
+            int valor = d[i - 1][j - 1] + custo;
+            if (d[i - 1][j] + 1 < valor) valor = d[i - 1][j] + 1;
+            if (d[i][j - 1] + 1 < valor) valor = d[i][j - 1] + 1;
+            d[i][j] = valor;
+        }
+    }
+    return d[tamA][tamB];
+}
+
+// Funções do modelo de referência
+EntradaReferencia* buscarReferencia(Referencia* ref, const char* pista) {
+    for (int i = 0; i < ref->tamMapa; i++) {
+        if (strcmp(ref->mapa[i].pista, pista) == 0) return &ref->mapa[i];
+    }
+    return NULL;
+}
+
+void inserirReferencia(Referencia* ref, const char* pista, const char* suspeito, const char* descricao) {
+    EntradaReferencia* entrada = buscarReferencia(ref, pista);
+    if (entrada == NULL) {
+        if (ref->tamMapa == ref->capMapa) {
+            ref->capMapa = ref->capMapa ? ref->capMapa * 2 : 64;
+            ref->mapa = (EntradaReferencia*)realloc(ref->mapa, ref->capMapa * sizeof(EntradaReferencia));
+            if (ref->mapa == NULL) falhar(-1, "referência", "falha de alocação");
+        }
+        entrada = &ref->mapa[ref->tamMapa++];
+        strcpy(entrada->pista, pista);
+    }
+    strcpy(entrada->suspeito, suspeito); // A inserção mais recente prevalece, como na tabela hash
+    strcpy(entrada->descricao, descricao);
+}
+
+// Busca binária no array ordenado; retorna a posição ou -(posição de inserção) - 1
+int posicaoOrdenada(Referencia* ref, const char* pista) {
+    int inicio = 0, fim = ref->tamOrdenadas - 1;
+    while (inicio <= fim) {
+        int meio = (inicio + fim) / 2;
+        int cmp = strcmp(pista, ref->ordenadas[meio]);
+        if (cmp == 0) return meio;
+        if (cmp < 0) fim = meio - 1;
+        else inicio = meio + 1;
+    }
+    return -inicio - 1;
+}
+
+void inserirOrdenada(Referencia* ref, const char* pista) {
+    int posicao = posicaoOrdenada(ref, pista);
+    if (posicao >= 0) return; // Duplicata ignorada, como na BST
+    posicao = -posicao - 1;
+    if (ref->tamOrdenadas == ref->capOrdenadas) {
+        ref->capOrdenadas = ref->capOrdenadas ? ref->capOrdenadas * 2 : 64;
+        ref->ordenadas = realloc(ref->ordenadas, ref->capOrdenadas * sizeof(*ref->ordenadas));
+        if (ref->ordenadas == NULL) falhar(-1, "referência", "falha de alocação");
+    }
+    memmove(ref->ordenadas[posicao + 1], ref->ordenadas[posicao], (ref->tamOrdenadas - posicao) * sizeof(*ref->ordenadas));
+    strcpy(ref->ordenadas[posicao], pista);
+    ref->tamOrdenadas++;
+}
+
+// Função para copiar as pistas da BST em ordem para um array
+void coletarEmOrdem(PistaNode* raiz, char (*destino)[50], int capacidade, int* total) {
+    if (raiz == NULL) return;
+    coletarEmOrdem(raiz->esquerda, destino, capacidade, total);
+    if (*total < capacidade) strcpy(destino[*total], raiz->pista);
+    (*total)++;
+    coletarEmOrdem(raiz->direita, destino, capacidade, total);
+}
+
+// Lista de pistas preenchida pelas buscas da BST (usada como contexto de VisitarPista)
+typedef struct {
+    char (*itens)[50];
+    int total;
+    int capacidade;
+} ListaPistas;
+
+// Função para guardar cada pista encontrada na lista do contexto
+void coletarPista(PistaNode* no, void* contexto) {
+    ListaPistas* lista = (ListaPistas*)contexto;
+    if (lista->total < lista->capacidade) strcpy(lista->itens[lista->total], no->pista);
+    lista->total++;
+}
+
+// Função para conferir uma lista de pistas com as pistas do modelo esperadas, em ordem
+void conferirLista(long operacao, const char* estrutura, ListaPistas* obtida, int retorno,
+                   char (*esperadas)[50], int numEsperadas) {
+    if (retorno != obtida->total) falhar(operacao, estrutura, "contagem retornada diferente das pistas visitadas");
+    if (obtida->total != numEsperadas) falhar(operacao, estrutura, "quantidade de pistas diferente do modelo");
+    for (int i = 0; i < numEsperadas; i++) {
+        if (strcmp(obtida->itens[i], esperadas[i]) != 0) falhar(operacao, estrutura, "pistas fora da ordem do modelo");
+    }
+}
+
+// Função para aplicar até edicoes alterações aleatórias (inserção, remoção, troca) em um texto
+void variarTexto(uint64_t* estado, char* texto, int edicoes) {
+    for (int e = 0; e < edicoes; e++) {
+        int tamanho = strlen(texto);
+        int posicao = aleatorio(estado) % (tamanho + 1);
+        int acao = aleatorio(estado) % 3;
+        if (acao == 0 && tamanho < 49) {
+            memmove(texto + posicao + 1, texto + posicao, tamanho - posicao + 1);
+            texto[posicao] = 'a' + aleatorio(estado) % 26;
+        } else if (acao == 1 && posicao < tamanho) {
+            memmove(texto + posicao, texto + posicao + 1, tamanho - posicao);
+        } else if (posicao < tamanho) {
+            texto[posicao] = 'A' + aleatorio(estado) % 26;
+        }
+    }
+}
+
+// Invariantes internos das estruturas
+// BST: cada pista fica estritamente entre os limites herdados dos ancestrais e tem
+// suspeito registrado na tabela hash (como no jogo, onde só pistas com suspeito são coletadas)
+int validarArvorePistas(PistaNode* raiz, TabelaHash* tabela, const char* minimo, const char* maximo) {
+    if (raiz == NULL) return 1;
+    if (minimo != NULL && strcmp(raiz->pista, minimo) <= 0) return 0;
+    if (maximo != NULL && strcmp(raiz->pista, maximo) >= 0) return 0;
+    if (encontrarSuspeito(tabela, raiz->pista) == NULL) return 0;
+    return validarArvorePistas(raiz->esquerda, tabela, minimo, raiz->pista)
+        && validarArvorePistas(raiz->direita, tabela, raiz->pista, maximo);
+}
+
+// Tabela hash: cada nó está no balde dado pela função de hash e a busca o encontra
+int validarTabelaHash(TabelaHash* tabela) {
+    for (int i = 0; i < TAMANHO_HASH; i++) {
+        for (HashNode* atual = tabela->tabela[i]; atual != NULL; atual = atual->proximo) {
+            if (funcaoHash(atual->pista) != (unsigned int)i) return 0;
+            if (atual->bit >= MAX_PISTAS_CASO) return 0;
+            HashNode* encontrado = encontrarSuspeito(tabela, atual->pista);
+            if (encontrado == NULL || strcmp(encontrado->pista, atual->pista) != 0) return 0;
+        }
+    }
+    return 1;
+}
+
+void verificarEstruturas(long operacao, TabelaHash* tabela, PistaNode* pistas) {
+    if (!validarTabelaHash(tabela)) falhar(operacao, "tabela hash", "invariante interno violado");
+    if (!validarArvorePistas(pistas, tabela, NULL, NULL)) falhar(operacao, "BST", "invariante interno violado");
+}
+
+// Função para conferir uma busca na tabela hash contra o modelo
+void conferirBuscaHash(long operacao, TabelaHash* tabela, Referencia* ref, const char* pista) {
+    HashNode* node = encontrarSuspeito(tabela, pista);
+    EntradaReferencia* esperado = buscarReferencia(ref, pista);
+    if ((node == NULL) != (esperado == NULL)) {
+        falhar(operacao, "tabela hash", esperado ? "pista existente não encontrada" : "pista inexistente encontrada");
+    }
+    if (node != NULL && (strcmp(node->suspeito, esperado->suspeito) != 0 ||
+                         strcmp(node->descricao, esperado->descricao) != 0)) {
+        falhar(operacao, "tabela hash", "suspeito ou descrição diferente do modelo");
+    }
+}
+
+// Função para montar uma árvore de salas aleatória com o número de salas pedido
+// Cada sala nova desce por um caminho sorteado até um filho vazio; retorna a altura esperada
+int montarSalasAleatorias(uint64_t* estado, Sala** raiz, int numSalas) {
+    int altura = -1;
+    for (int i = 0; i < numSalas; i++) {
+        char nome[50];
+        sprintf(nome, "Sala %d", i);
+        Sala** posicao = raiz;
+        int profundidade = 0;
+        while (*posicao != NULL) {
+            posicao = (aleatorio(estado) & 1) ? &(*posicao)->esquerda : &(*posicao)->direita;
+            profundidade++;
+        }
+        *posicao = criarSala(nome, NULL);
+        if (profundidade > altura) altura = profundidade;
+    }
+    return altura;
+}
+
+// Função de contagem de salas usada para conferir a árvore montada
+int contarSalas(Sala* sala) {
+    if (sala == NULL) return 0;
+    return 1 + contarSalas(sala->esquerda) + contarSalas(sala->direita);
+}
+
+// Fase 1: operações aleatórias comparadas com o modelo de referência após cada passo
+void testeDiferencial(uint64_t semente, long operacoes) {
+    uint64_t estado = semente;
+    TabelaHash* tabela = criarTabelaHash();
+    PistaNode* pistas = NULL;
+    Referencia ref;
+    memset(&ref, 0, sizeof(ref));
+    char (*emOrdem)[50] = malloc(NUM_CHAVES * sizeof(*emOrdem));
+    char (*esperadas)[50] = malloc(NUM_CHAVES * sizeof(*esperadas));
+    ListaPistas obtida = {malloc(NUM_CHAVES * sizeof(*obtida.itens)), 0, NUM_CHAVES};
+    long contagem[11] = {0};
+    static const char* nomes[11] = {"inserir na hash", "buscar na hash", "inserir na BST", "buscar na BST",
+                                    "percorrer BST", "distância de edição", "árvore de salas", "liberar tudo",
+                                    "busca por prefixo", "busca por início parecido", "corrigir suspeito"};
+
+    for (long op = 0; op < operacoes; op++) {
+        const char* pista = chaves[aleatorio(&estado) % NUM_CHAVES];
+        int sorteio = aleatorio(&estado) % 1000;
+        int tipo = sorteio < 270 ? 0 : sorteio < 480 ? 1 : sorteio < 650 ? 2 : sorteio < 780 ? 3
+                 : sorteio < 810 ? 4 : sorteio < 860 ? 5 : sorteio < 868 ? 6 : sorteio < 928 ? 8
+                 : sorteio < 958 ? 9 : sorteio < 998 ? 10 : 7;
+        contagem[tipo]++;
+
+        if (tipo == 0) {
+            char descricao[100];
+            const char* suspeito = SUSPEITOS[aleatorio(&estado) % 5];
+            textoAleatorio(&estado, descricao, 99);
+            inserirNaHash(tabela, pista, suspeito, descricao);
+            inserirReferencia(&ref, pista, suspeito, descricao);
+            conferirBuscaHash(op, tabela, &ref, pista);
+        } else if (tipo == 1) {
+            conferirBuscaHash(op, tabela, &ref, pista);
+        } else if (tipo == 2) {
+            // Como no jogo, só entram na BST pistas com suspeito registrado na tabela hash
+            if (buscarReferencia(&ref, pista) == NULL) {
+                const char* suspeito = SUSPEITOS[aleatorio(&estado) % 5];
+                inserirNaHash(tabela, pista, suspeito, "Descrição");
+                inserirReferencia(&ref, pista, suspeito, "Descrição");
+            }
+            pistas = inserirPista(pistas, pista);
+            inserirOrdenada(&ref, pista);
+            if (buscarPista(pistas, pista) == NULL) falhar(op, "BST", "pista inserida não encontrada");
+        } else if (tipo == 3) {
+            int esperado = posicaoOrdenada(&ref, pista) >= 0;
+            if ((buscarPista(pistas, pista) != NULL) != esperado) {
+                falhar(op, "BST", esperado ? "pista coletada não encontrada" : "pista não coletada encontrada");
+            }
+        } else if (tipo == 4) {
+            int total = 0;
+            coletarEmOrdem(pistas, emOrdem, NUM_CHAVES, &total);
+            if (total != ref.tamOrdenadas) falhar(op, "BST", "percurso em ordem com tamanho diferente do modelo");
+            for (int i = 0; i < total; i++) {
+                if (strcmp(emOrdem[i], ref.ordenadas[i]) != 0) falhar(op, "BST", "percurso em ordem fora da ordem do modelo");
+            }
+            for (int i = 0; i < ref.tamMapa; i++) {
+                conferirBuscaHash(op, tabela, &ref, ref.mapa[i].pista);
+            }
+            verificarEstruturas(op, tabela, pistas);
+        } else if (tipo == 5) {
+            // Compara com uma variação da pista (até 3 edições) para exercitar o corte por limite
+            char variacao[50];
+            strcpy(variacao, pista);
+            variarTexto(&estado, variacao, aleatorio(&estado) % 4);
+            int limite = aleatorio(&estado) % 4;
+            int esperado = distanciaReferencia(pista, variacao);
+            if (esperado > limite) esperado = limite + 1;
+            if (distanciaEdicao(pista, variacao, limite) != esperado) {
+                falhar(op, "distância de edição", "resultado diferente da distância completa");
+            }
+        } else if (tipo == 6) {
+            Sala* raiz = NULL;
+            int numSalas = 1 + aleatorio(&estado) % 200;
+            int altura = montarSalasAleatorias(&estado, &raiz, numSalas);
+            if (contarSalas(raiz) != numSalas) falhar(op, "árvore de salas", "número de salas diferente do montado");
+            if (alturaArvoreSalas(raiz) != altura) falhar(op, "árvore de salas", "altura diferente do modelo");
+            liberarArvoreSalas(raiz);
+        } else if (tipo == 8) {
+            // Prefixo de tamanho sorteado (inclusive vazio) de uma pista, às vezes alterado
+            char prefixo[50];
+            snprintf(prefixo, sizeof(prefixo), "%.*s", (int)(aleatorio(&estado) % (strlen(pista) + 1)), pista);
+            if (aleatorio(&estado) % 4 == 0) variarTexto(&estado, prefixo, 1);
+            int numEsperadas = 0;
+            for (int i = 0; i < ref.tamOrdenadas; i++) {
+                if (strncmp(ref.ordenadas[i], prefixo, strlen(prefixo)) == 0) strcpy(esperadas[numEsperadas++], ref.ordenadas[i]);
+            }
+            obtida.total = 0;
+            int retorno = buscarPistasPorPrefixo(pistas, prefixo, coletarPista, &obtida);
+            conferirLista(op, "busca por prefixo", &obtida, retorno, esperadas, numEsperadas);
+        } else if (tipo == 9) {
+            // Início de uma pista com até 3 erros de digitação
+            char termo[50];
+            snprintf(termo, sizeof(termo), "%.*s", (int)(1 + aleatorio(&estado) % strlen(pista)), pista);
+            variarTexto(&estado, termo, aleatorio(&estado) % 4);
+            int numEsperadas = 0;
+            for (int i = 0; i < ref.tamOrdenadas; i++) {
+                char inicio[50];
+                snprintf(inicio, sizeof(inicio), "%.*s", (int)strlen(termo), ref.ordenadas[i]);
+                if (distanciaReferencia(termo, inicio) <= LIMITE_EDICAO) strcpy(esperadas[numEsperadas++], ref.ordenadas[i]);
+            }
+            obtida.total = 0;
+            int retorno = buscarPistasParecidas(pistas, termo, coletarPista, &obtida);
+            conferirLista(op, "busca por início parecido", &obtida, retorno, esperadas, numEsperadas);
+        } else if (tipo == 10) {
+            // Nome de suspeito com até 3 erros; deve voltar o exato ou um dos mais próximos
+            char nome[50];
+            strcpy(nome, SUSPEITOS[aleatorio(&estado) % 5]);
+            variarTexto(&estado, nome, aleatorio(&estado) % 4);
+            int exato = 0, menor = LIMITE_EDICAO + 1;
+            for (int i = 0; i < ref.tamMapa; i++) {
+                if (strcmp(ref.mapa[i].suspeito, nome) == 0) exato = 1;
+                int distancia = distanciaReferencia(nome, ref.mapa[i].suspeito);
+                if (distancia < menor) menor = distancia;
+            }
+            const char* obtido = suspeitoMaisProximo(tabela, nome);
+            if (exato) {
+                if (obtido == NULL || strcmp(obtido, nome) != 0) falhar(op, "corrigir suspeito", "nome exato não preservado");
+            } else if (menor > LIMITE_EDICAO) {
+                if (obtido != NULL) falhar(op, "corrigir suspeito", "correção fora do limite de edição");
+            } else if (obtido == NULL || distanciaReferencia(nome, obtido) != menor) {
+                falhar(op, "corrigir suspeito", "suspeito sugerido não é o mais próximo");
+            }
+        } else {
+            verificarEstruturas(op, tabela, pistas);
+            liberarTabelaHash(tabela);
+            liberarArvorePistas(pistas);
+            tabela = criarTabelaHash();
+            pistas = NULL;
+            ref.tamMapa = 0;
+            ref.tamOrdenadas = 0;
+        }
+    }
+
+    printf("Teste diferencial: %ld operações sem divergências (semente %llu)\n",
+           operacoes, (unsigned long long)semente);
+    for (int i = 0; i < 11; i++) {
+        printf(" - %s: %ld\n", nomes[i], contagem[i]);
+    }
+
+    verificarEstruturas(operacoes, tabela, pistas);
+    liberarTabelaHash(tabela);
+    liberarArvorePistas(pistas);
+    free(ref.mapa);
+    free(ref.ordenadas);
+    free(emOrdem);
+    free(esperadas);
+    free(obtida.itens);
+}
+
+// Função para exibir a vazão medida de uma estrutura
+void exibirVazao(const char* estrutura, long operacoes, clock_t inicio) {
+    double segundos = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    if (segundos <= 0) segundos = 1.0 / CLOCKS_PER_SEC;
+    printf(" - %s: %.0f ops/s (%ld operações)\n", estrutura, operacoes / segundos, operacoes);
+}
+
+// Fase 2: vazão de cada estrutura, em lotes de LOTE inserções e LOTE buscas seguidos de liberação
+void medirVazao(uint64_t semente, long operacoes) {
+    uint64_t estado = semente;
+    long lotes = operacoes / (2 * LOTE) + 1;
+    volatile long encontrados = 0; // Impede que o compilador descarte as buscas
+
+    printf("\nVazão por estrutura:\n");
+
+    clock_t inicio = clock();
+    for (long l = 0; l < lotes; l++) {
+        TabelaHash* tabela = criarTabelaHash();
+        for (int i = 0; i < LOTE; i++) {
+            inserirNaHash(tabela, chaves[aleatorio(&estado) % NUM_CHAVES], "Coronel", "Descrição");
+        }
+        for (int i = 0; i < LOTE; i++) {
+            encontrados += encontrarSuspeito(tabela, chaves[aleatorio(&estado) % NUM_CHAVES]) != NULL;
+        }
+        liberarTabelaHash(tabela);
+    }
+    exibirVazao("tabela hash", lotes * 2 * LOTE, inicio);
+
+    inicio = clock();
+    for (long l = 0; l < lotes; l++) {
+        PistaNode* pistas = NULL;
+        for (int i = 0; i < LOTE; i++) {
+            pistas = inserirPista(pistas, chaves[aleatorio(&estado) % NUM_CHAVES]);
+        }
+        for (int i = 0; i < LOTE; i++) {
+            encontrados += buscarPista(pistas, chaves[aleatorio(&estado) % NUM_CHAVES]) != NULL;
+        }
+        liberarArvorePistas(pistas);
+    }
+    exibirVazao("BST de pistas", lotes * 2 * LOTE, inicio);
+
+    inicio = clock();
+    for (long l = 0; l < lotes * 2 * LOTE; l++) {
+        encontrados += distanciaEdicao(chaves[aleatorio(&estado) % NUM_CHAVES],
+                                       chaves[aleatorio(&estado) % NUM_CHAVES], LIMITE_EDICAO) <= LIMITE_EDICAO;
+    }
+    exibirVazao("distância de edição", lotes * 2 * LOTE, inicio);
+
+    inicio = clock();
+    for (long l = 0; l < lotes; l++) {
+        Sala* raiz = NULL;
+        montarSalasAleatorias(&estado, &raiz, LOTE);
+        encontrados += alturaArvoreSalas(raiz);
+        liberarArvoreSalas(raiz);
+    }
+    exibirVazao("árvore de salas", lotes * LOTE, inicio);
+}
+
+// Função principal do teste: semente e número de operações opcionais
+int main(int argc, char* argv[]) {
+    uint64_t semente = argc > 1 ? strtoull(argv[1], NULL, 10) : 42;
+    long operacoes = argc > 2 ? strtol(argv[2], NULL, 10) : 100000;
+    if (semente == 0) semente = 1; // O xorshift não sai do zero
+    if (operacoes <= 0) {
+        printf("Uso: %s [semente] [operacoes]\n", argv[0]);
+        return 1;
+    }
+
+    // Conjunto fixo de pistas sorteadas; algumas diferem só em maiúsculas/minúsculas
+    uint64_t estado = semente;
+    for (int i = 0; i < NUM_CHAVES; i++) {
+        if (i > 0 && aleatorio(&estado) % 8 == 0) {
+            strcpy(chaves[i], chaves[i - 1]);
+            chaves[i][0] = isupper((unsigned char)chaves[i][0]) ? tolower((unsigned char)chaves[i][0])
+                                                                 : toupper((unsigned char)chaves[i][0]);
+        } else {
+            textoAleatorio(&estado, chaves[i], 49);
+        }
+    }
+
+    testeDiferencial(semente, operacoes);
+    medirVazao(semente, operacoes);
+    return 0;
+}